@@ -0,0 +1,138 @@
+#ifndef BITMAP_H
+#define BITMAP_H
+
+#include "index.h"
+
+
+#define BITMAPSUFFIX   ".bitmap"        // suffix of index file name
+#define SLOTSPERPAGE   (PAGESIZE / sizeof(slot_t)) // bound on RIDs per page
+#define WORDSPERPAGE   ((PAGESIZE - sizeof(BitmapPage)) / sizeof(unsigned))
+
+// A bitmap has a bit for every RID, bit pageNo * SLOTSPERPAGE + slotNo
+// being set when the record at (pageNo, slotNo) has the value. It is
+// compressed word-aligned hybrid (WAH) style: every 32-bit word is
+// either a literal, whose low 31 bits are the next 31 bits of the
+// bitmap, or a fill, standing for a run of groups of 31 equal bits.
+// A bitmap ends after its last set bit.
+
+#define WAHFILL        0x80000000U      // word is a fill
+#define WAHFILLBIT     0x40000000U      // value of the bits of a fill
+#define WAHRUNMASK     0x3fffffffU      // # of groups of a fill
+#define WAHLITMASK     0x7fffffffU      // bits of a literal
+#define WAHGROUP       31               // bits per group
+
+
+// header page of a bitmap index; the value directory follows it on
+// the page, valueCnt entries of a BitmapValue and the key padded to
+// whole words
+
+typedef struct {
+  int keyType;                          // INTEGER, FLOAT, or STRING
+  int keyLen;                           // length of key in bytes
+  int keyOffset;                        // offset of key in record
+  int valueCnt;                         // number of distinct values
+  int entryCnt;                         // number of entries in the index
+} BitmapHdr;
+
+
+// directory entry of a value: where its bitmap is kept
+
+typedef struct {
+  int firstPage;                        // first page of bitmap, -1 if none
+  int lastPage;                         // last page of bitmap
+  int wordCnt;                          // # of words of the bitmap
+  int groupCnt;                         // # of groups of 31 bits it spans
+  int setCnt;                           // # of records with the value
+} BitmapValue;
+
+
+// every page of a bitmap starts with this header, the words follow
+
+typedef struct {
+  int nextPage;                         // next page of bitmap, -1 if none
+  int wordCnt;                          // # of words on this page
+} BitmapPage;
+
+
+// a scan reads the bitmaps of the values it looks for into memory and
+// walks them in step with one of these each
+
+typedef struct {
+  int value;                            // directory entry of the value
+  unsigned* words;                      // the bitmap
+  int wordCnt;                          // # of words
+  int word;                             // current word
+  int base;                             // bit # of its first bit
+  int bit;                              // next bit of it to look at
+  int next;                             // next set bit, -1 at the end
+} BitmapCursor;
+
+
+class BitmapIndex : public Index {
+ public:
+  // open the bitmap index in file fileName
+  BitmapIndex(const string & fileName, Status & status);
+
+  // close it
+  ~BitmapIndex();
+
+  const Status insertEntry(const Record & rec, const RID & rid);
+  const Status deleteEntry(const Record & rec, const RID & rid);
+  const Status truncate();
+
+  const bool supports(const Operator op) const
+    {
+      return op == EQ || op == NE;
+    }
+  const bool covers(const AttrDesc & attr) const
+    {
+      return attr.attrOffset == hdr->keyOffset;
+    }
+
+  const Status startScan(const void* value, const Operator op);
+  const Status scanNext(RID & rid);
+  const Status getCovered(char* recData);
+  const Status endScan();
+
+ private:
+  File* filePtr;                        // index file
+  BitmapHdr* hdr;                       // pinned header page
+  int hdrPageNo;                        // page # of header page
+  bool hdrDirty;                        // header page has been updated
+
+  int valueSize;                        // bytes per directory entry
+  int valueCap;                         // max. # of distinct values
+
+  // state of the current scan
+  BitmapCursor* cursors;                // one per value scanned
+  int cursorCnt;                        // # of cursors
+  int scanValue;                        // value of the RID returned last
+
+  int keycmp(const char* k1, const char* k2) const;
+
+  // directory entry i, and its key
+  BitmapValue* value(const int i) const;
+  char* valueKey(const int i) const;
+
+  // directory entry holding key, -1 if none
+  int findValue(const char* key) const;
+
+  // read bitmap of value i into memory / replace it with words
+  const Status readBitmap(const int i, unsigned* & words, int & wordCnt);
+  const Status writeBitmap(const int i, const unsigned* words,
+			   const int wordCnt);
+
+  // set bit pos of value i, which is past all but the last group, by
+  // changing the last page of its bitmap only
+  const Status appendBit(const int i, const int pos);
+
+  // give the pages of the bitmap of value i back to the file
+  const Status disposeBitmap(const int i);
+};
+
+
+// create an empty bitmap index on the key attribute of a relation
+extern const Status createBitmap(const string & fileName,
+				 const AttrDesc & key);
+
+#endif
@@ -0,0 +1,150 @@
+#ifndef BTREE_H
+#define BTREE_H
+
+#include "index.h"
+
+
+#define BTREESUFFIX ".btree"            // suffix of index file name
+#define MAXINCLUDE  8                   // max. # of included attributes
+#define BTREEFILL   90                  // % of a node filled by bulkLoad
+#define MAXHEIGHT   16                  // max. # of levels bulkLoad builds
+
+
+// header page of a B+-tree file
+
+typedef struct {
+  int keyType;                          // INTEGER, FLOAT, or STRING
+  int keyLen;                           // length of key in bytes
+  int keyOffset;                        // offset of key in record
+  int rootPageNo;                       // page # of root node
+  int height;                           // number of levels, 1 = root is leaf
+  int entryCnt;                         // number of entries in the tree
+  int includeCnt;                       // number of included attributes
+  int includeLen;                       // their total length in bytes
+  IndexAttr includes[MAXINCLUDE];       // attributes copied into leaves
+} BTreeHdr;
+
+
+// every node page starts with this header. Entries follow it:
+//   leaf:      key, RID, values of included attributes
+//   internal:  key, RID, child page #
+// The RID makes equal keys distinct, so every entry of the tree is
+// unique and the tree can hold duplicate keys. All entries in the
+// subtree of an internal entry's child are >= (key, RID); those
+// smaller than the node's first entry are under firstChild.
+
+typedef struct {
+  int level;                            // 0 for leaves
+  int keyCnt;                           // number of entries on node
+  int nextPage;                         // right sibling of leaf, -1 if none
+  int firstChild;                       // leftmost child of internal node
+} BTreeNode;
+
+
+// the node bulkLoad is filling on one level of the tree
+
+typedef struct {
+  int pageNo;                           // page # of node
+  BTreeNode* node;                      // the pinned node
+} BulkLevel;
+
+
+class BTreeIndex : public Index {
+ public:
+  // open the B+-tree in file fileName
+  BTreeIndex(const string & fileName, Status & status);
+
+  // close it
+  ~BTreeIndex();
+
+  const Status insertEntry(const Record & rec, const RID & rid);
+  const Status deleteEntry(const Record & rec, const RID & rid);
+  const Status truncate();
+
+  // Enter every record of relation into the tree, which must be
+  // empty. The entries are sorted with a SortedFile and the tree is
+  // built bottom-up, nodes being filled to fillFactor percent.
+  const Status bulkLoad(const string & relation, const int fillFactor);
+
+  const bool supports(const Operator op) const
+    {
+      return op != NE;
+    }
+  const bool covers(const AttrDesc & attr) const;
+
+  const Status startScan(const void* value, const Operator op);
+  const Status scanNext(RID & rid);
+  const Status getCovered(char* recData);
+  const Status endScan();
+
+ private:
+  File* filePtr;                        // index file
+  BTreeHdr* hdr;                        // pinned header page
+  int hdrPageNo;                        // page # of header page
+  bool hdrDirty;                        // header page has been updated
+
+  int keySize;                          // bytes of key and RID
+  int leafEntrySize;                    // bytes per leaf entry
+  int nodeEntrySize;                    // bytes per internal entry
+  int leafCap;                          // max. entries on a leaf
+  int nodeCap;                          // max. entries on an internal node
+
+  // state of the current scan
+  char* scanValue;                      // key compared against
+  Operator scanOp;                      // comparison operator
+  Page* scanPage;                       // pinned leaf, NULL if none
+  int scanPageNo;                       // page # of pinned leaf
+  int scanPos;                          // next entry on the leaf
+
+  // the leaf entry of record rec stored at rid
+  void makeEntry(const Record & rec, const RID & rid, char* entry) const;
+
+  // compare keys, and entries (key plus RID)
+  int keycmp(const char* k1, const char* k2) const;
+  int entrycmp(const char* e1, const char* e2) const;
+
+  // first position on node whose entry is > entry (>= if equal)
+  int search(const BTreeNode* node, const char* entry,
+	     const bool equal) const;
+
+  // child of internal node that holds entry
+  int childFor(const BTreeNode* node, const char* entry) const;
+
+  // add entry to the subtree rooted at pageNo. If the root of the
+  // subtree splits, split is set and upEntry / upPageNo give the
+  // entry to add to the parent
+  const Status insertInto(const int pageNo, const char* entry,
+			  bool & split, char* upEntry, int & upPageNo);
+
+  // descend to the leaf that holds entry
+  const Status findLeaf(const char* entry, int & pageNo, Page* & page);
+
+  // give the pages of the subtree rooted at pageNo back to the file
+  const Status disposeTree(const int pageNo);
+
+  // sort the entries in file entryFile, unless they are in order
+  // already, and build the tree of them
+  const Status bulkBuild(const string & entryFile, const bool inOrder,
+			 const int fillFactor);
+
+  // append leaf entry to the last leaf of a bulk load
+  const Status bulkAdd(const char* entry, BulkLevel levels[],
+		       int & height, const int leafFill, const int nodeFill);
+
+  // add the entry (sep, newPageNo) to the last node on level of a
+  // bulk load; oldPageNo is the node before newPageNo on the level
+  // below, the first child of a new root
+  const Status bulkPush(int level, const char* sep, const int oldPageNo,
+			const int newPageNo, BulkLevel levels[],
+			int & height, const int nodeFill);
+};
+
+
+// create an empty B+-tree on the key attribute of a relation; the
+// leaves also hold the values of includeCnt included attributes
+extern const Status createBTree(const string & fileName,
+				const AttrDesc & key,
+				const int includeCnt,
+				const AttrDesc includes[]);
+
+#endif
@@ -128,6 +128,9 @@ public:
   const Status disposePage(File* file, const int PageNo); // dispose of page in file
   void  printSelf();
 
+  // number of frames in the buffer pool
+  const int getNumBufs() const { return numBufs; }
+
   const BufStats & getBufStats() const // get buffer pool usage
   {
 	return bufStats;
@@ -12,6 +12,7 @@
 #define ATTRCATNAME  "attrcat"          // name of attribute catalog
 #define MAXNAME      32                 // length of relName, attrName
 #define MAXSTRINGLEN 255                // max. length of string attribute
+#define CATHTSIZE    31                 // buckets in catalog cache
 
 
 // schema of relation catalog:
@@ -34,6 +35,69 @@ typedef struct {
 } attrInfo; 
 
 
+// schema of attribute catalog:
+//   relation name : char(32)           <-- lookup keys
+//   attribute name : char(32)          <--
+//   attribute number : integer(4)
+//   attribute type : integer(4)  (type is Datatype actually)
+//   attribute size : integer(4)
+//   index type : integer(4)  (type is IndexType actually)
+
+
+typedef struct {
+  char relName[MAXNAME];                // relation name
+  char attrName[MAXNAME];               // attribute name
+  int attrOffset;                       // attribute offset
+  int attrType;                         // attribute type
+  int attrLen;                          // attribute length
+  int indexType;                        // kind of index on attribute
+} AttrDesc;
+
+
+// The catalogs keep their tuples in a write-through cache so that
+// lookups do not have to scan relcat and attrcat. The cache is loaded
+// when a catalog is opened and updated by addInfo() and removeInfo().
+// Every relation has one bucket; the relation catalog fills in the
+// relcat tuple, the attribute catalog the attrcat tuples. The RIDs
+// are kept so that tuples can be removed without a scan.
+
+struct catBucket
+{
+  char relName[MAXNAME];                // relation name (hash key)
+  bool relValid;                        // rel and relRid are set
+  RelDesc rel;                          // relcat tuple
+  RID relRid;                           // RID of relcat tuple
+  int attrCnt;                          // number of attrcat tuples
+  AttrDesc* attrs;                      // attrcat tuples, in catalog order
+  RID* attrRids;                        // RIDs of attrcat tuples
+  catBucket* next;                      // next bucket in hash chain
+};
+
+
+class CatHashTbl
+{
+ private:
+  int HTSIZE;
+  catBucket** ht;                       // actual hash table
+  int hash(const string & relation) const; // returns value between 0 and HTSIZE-1
+
+ public:
+  CatHashTbl(const int htSize);         // constructor
+  ~CatHashTbl();                        // destructor
+
+  // return the bucket of relation. If there is none, one is created
+  // when create is true, otherwise NULL is returned
+  catBucket* lookup(const string & relation, const bool create);
+
+  // add an attrcat tuple to the bucket of relation
+  const Status addAttr(const string & relation, const AttrDesc & record,
+		       const RID & rid);
+
+  // delete bucket if it holds neither a relcat nor attrcat tuple
+  void release(catBucket* bucket);
+};
+
+
 class RelCatalog : public HeapFile {
  public:
   // open relation catalog
@@ -61,24 +125,13 @@ class RelCatalog : public HeapFile {
 
   // get rid of catalog
   ~RelCatalog();
-};
-
-
-// schema of attribute catalog:
-//   relation name : char(32)           <-- lookup keys
-//   attribute name : char(32)          <--
-//   attribute number : integer(4)
-//   attribute type : integer(4)  (type is Datatype actually)
-//   attribute size : integer(4)
 
+ private:
+  CatHashTbl cache;                     // relcat tuples by relation name
 
-typedef struct {
-  char relName[MAXNAME];                // relation name
-  char attrName[MAXNAME];               // attribute name
-  int attrOffset;                       // attribute offset
-  int attrType;                         // attribute type
-  int attrLen;                          // attribute length
-} AttrDesc;
+  // read all relcat tuples into the cache
+  const Status loadCache();
+};
 
 
 class AttrCatalog : public HeapFile {
@@ -104,18 +157,25 @@ class AttrCatalog : public HeapFile {
 			  int &attrCnt, 
 			  AttrDesc *&attrs);
 
+  // update attribute catalog tuple in place
+  const Status updateInfo(const AttrDesc & record);
+
   // delete all information about a relation
   const Status dropRelation(const string & relation);
 
   // close attribute catalog
   ~AttrCatalog();
+
+ private:
+  CatHashTbl cache;                     // attrcat tuples by relation name
+
+  // read all attrcat tuples into the cache
+  const Status loadCache();
 };
 
 
 extern RelCatalog  *relCat;
 extern AttrCatalog *attrCat;
 extern Error error;
-extern Status createHeapFile(const string filename);
-extern Status destroyHeapFile(const string filename);
 
 #endif
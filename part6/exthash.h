@@ -0,0 +1,111 @@
+#ifndef EXTHASH_H
+#define EXTHASH_H
+
+#include "index.h"
+
+
+#define EXTHASHSUFFIX ".hash"           // suffix of index file name
+#define DIRPERPAGE    (PAGESIZE / sizeof(int)) // directory entries on a page
+#define MAXDIRPAGES   64                // max. pages of directory
+#define MAXHASHDEPTH  14                // log2(DIRPERPAGE * MAXDIRPAGES)
+
+
+// header page of an extendible hash file. The directory has
+// 2^globalDepth entries, each the page # of a bucket, and is stored
+// DIRPERPAGE entries to a page in the pages listed in dirPages
+
+typedef struct {
+  int keyType;                          // INTEGER, FLOAT, or STRING
+  int keyLen;                           // length of key in bytes
+  int keyOffset;                        // offset of key in record
+  int globalDepth;                      // # of hash bits used by directory
+  int entryCnt;                         // number of entries in the index
+  int dirPageCnt;                       // number of directory pages
+  int dirPages[MAXDIRPAGES];            // page #s of directory pages
+} ExtHashHdr;
+
+
+// every bucket page starts with this header, followed by keyCnt
+// entries (key, RID). 2^(globalDepth - localDepth) directory entries
+// point to a bucket; all keys in it agree in their low localDepth
+// hash bits. Keys that cannot be told apart by MAXHASHDEPTH bits
+// (duplicates, mostly) go on a chain of overflow pages.
+
+typedef struct {
+  int localDepth;                       // # of hash bits shared by keys
+  int keyCnt;                           // number of entries on page
+  int overflowPage;                     // next page of bucket, -1 if none
+} ExtHashBucket;
+
+
+class ExtHashIndex : public Index {
+ public:
+  // open the hash index in file fileName
+  ExtHashIndex(const string & fileName, Status & status);
+
+  // close it
+  ~ExtHashIndex();
+
+  const Status insertEntry(const Record & rec, const RID & rid);
+  const Status deleteEntry(const Record & rec, const RID & rid);
+  const Status truncate();
+
+  const bool supports(const Operator op) const
+    {
+      return op == EQ;
+    }
+  const bool covers(const AttrDesc & attr) const
+    {
+      return attr.attrOffset == hdr->keyOffset;
+    }
+
+  const Status startScan(const void* value, const Operator op);
+  const Status scanNext(RID & rid);
+  const Status getCovered(char* recData);
+  const Status endScan();
+
+ private:
+  File* filePtr;                        // index file
+  ExtHashHdr* hdr;                      // pinned header page
+  int hdrPageNo;                        // page # of header page
+  bool hdrDirty;                        // header page has been updated
+
+  int entrySize;                        // bytes per entry
+  int bucketCap;                        // max. entries on a bucket page
+
+  // state of the current scan
+  char* scanValue;                      // key looked for
+  Page* scanPage;                       // pinned bucket page, NULL if none
+  int scanPageNo;                       // page # of pinned page
+  int scanPos;                          // next entry on the page
+
+  // hash value of a key; keys equal under keycmp hash alike
+  unsigned int hash(const char* key) const;
+  int keycmp(const char* k1, const char* k2) const;
+
+  // read / write directory entry i
+  const Status getDir(const int i, int & pageNo);
+  const Status setDir(const int i, const int pageNo);
+
+  // double the directory
+  const Status doubleDir();
+
+  // split the bucket at pageNo that directory entry i points to
+  const Status split(const int pageNo, const int i);
+
+  // append entry to the bucket at pageNo, adding an overflow page
+  // if the bucket is full
+  const Status append(const int pageNo, const char* entry);
+
+  // give a bucket page and its overflow pages back to the file
+  const Status disposeBucket(const int pageNo);
+};
+
+
+// create an empty extendible hash index on the key attribute of a
+// relation, with at least nbuckets buckets
+extern const Status createExtHash(const string & fileName,
+				  const AttrDesc & key,
+				  const int nbuckets);
+
+#endif
@@ -12,6 +12,7 @@ using namespace std;
 
 #include "page.h"
 #include "buf.h"
+#include "zonemap.h"
 
 extern DB db;
 
@@ -34,6 +35,10 @@ struct FileHdrPage
 };
 
 
+// create and destroy a heap file
+const Status createHeapFile(const string fileName);
+const Status destroyHeapFile(const string fileName);
+
 // class definition of heapFile
 class HeapFile {
 protected:
@@ -46,6 +51,7 @@ protected:
    int   	curPageNo;	// page number of pinned page
    bool  	curDirtyFlag;   // true if page has been updated
    RID   	curRec;         // rid of last record returned
+   ZoneMap*	zoneMap;	// page summaries, NULL if file has none
 
 public:
 
@@ -58,8 +64,58 @@ public:
   // return number of records in file
   const int getRecCnt() const;
 
+  // return number of data pages in file
+  const int getPageCnt() const;
+
   // given a RID, read record from file, returning pointer and length
   const Status getRecord(const RID &rid, Record & rec);
+
+  // given a list of RIDs, read the records visiting each page once.
+  // fcn is called for every record, in page order, along with the
+  // position of its RID in the list
+  const Status getRecords(const RID rids[], const int ridCnt,
+			  const Status (*fcn)(const Record & rec,
+					      const int pos,
+					      void* arg),
+			  void* arg);
+
+  // same, but copy the records into buf (bufLen bytes) and return
+  // them in recs[] in the order of the list
+  const Status getRecords(const RID rids[], const int ridCnt,
+			  Record recs[], char* buf, const int bufLen);
+
+  // pin a block of up to maxPages data pages, from page pageNo on
+  // (-1 for the first page of the file), into pages[] and pageNos[].
+  // pageNo returns the page after the block, -1 after the last one
+  const Status pinBlock(int & pageNo, const int maxPages,
+			Page* pages[], int pageNos[], int & pageCnt);
+
+  // unpin the pages of a block
+  const Status unpinBlock(const int pageNos[], const int pageCnt);
+
+  // give pages emptied by deletions back to the file. If merge is
+  // true, records are first moved from the tail of the file into
+  // free space of earlier pages (changing their RIDs). pagesFreed
+  // returns the number of pages unlinked
+  const Status vacuum(const bool merge, int & pagesFreed);
+};
+
+
+struct ScanStats
+{
+  int pagesRead;     // Number of data pages examined by the scan
+  int pagesSkipped;  // Number of data pages ruled out by the zone map
+  int pagesEmptied;  // Number of data pages left empty by deleteRecord()
+
+  void clear()
+    {
+      pagesRead = pagesSkipped = pagesEmptied = 0;
+    }
+
+  ScanStats()
+    {
+      clear();
+    }
 };
 
 
@@ -81,6 +137,7 @@ public:
     const Status endScan(); // terminate the scan
     const Status markScan(); // save current position of scan
     const Status resetScan(); // reset scan to last marked location
+    const Status rewindScan(); // start over at the first page
 
     // return RID of next record that satisfies the scan 
     const Status scanNext(RID& outRid);
@@ -91,9 +148,23 @@ public:
     // delete current record 
     const Status deleteRecord();
 
+    // delete record rid, making its page the current page
+    const Status deleteRecord(const RID & rid);
+
     // marks current page of scan dirty
     const Status markDirty();
 
+    // also require fcn(rec, arg) of the records the scan returns,
+    // from now on; NULL for no such test
+    const Status setRecFilter(const bool (*fcn)(const Record & rec,
+						void* arg),
+			      void* arg);
+
+    const ScanStats & getScanStats() const // get scan statistics
+    {
+	return scanStats;
+    }
+
 private:
     int   offset;            // byte offset of filter attribute
     int   length;            // length of filter attribute
@@ -108,7 +179,15 @@ private:
     int   markedPageNo;	// page number of pinned page
     RID   markedRec;         // rid of last record returned
 
+    const bool (*recFilter)(const Record & rec, void* arg);
+    void* recFilterArg;      // extra test of records, see setRecFilter
+
+    int   zoneAttr;          // zone map attribute of filter, -1 if none
+    bool  zoneStale;         // records deleted from current page
+    ScanStats scanStats;     // pages read and skipped
+
     const bool matchRec(const Record & rec) const;
+    const Status refreshZone(); // resummarize current page if stale
 };
 
 
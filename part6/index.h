@@ -0,0 +1,115 @@
+#ifndef INDEX_H
+#define INDEX_H
+
+#include "catalog.h"
+
+// define if debug output wanted
+//#define DEBUGIND
+
+
+// kinds of index, stored in AttrDesc.indexType
+
+enum IndexType { NOIDX, BTREEIDX, HASHIDX, BITMAPIDX };
+
+
+// an attribute whose values an index keeps, by its place in the record
+
+typedef struct {
+  int offset;                           // byte offset in record
+  int length;                           // length of attribute
+} IndexAttr;
+
+
+// An index maps the values of one attribute of a relation to the
+// RIDs of the records holding them. All kinds of index share this
+// interface; openIndex() returns the right one for an attribute.
+
+class Index {
+ public:
+  virtual ~Index() {}
+
+  // add the entry for record rec stored at rid
+  virtual const Status insertEntry(const Record & rec, const RID & rid) = 0;
+
+  // remove the entry for record rec stored at rid; RECNOTFOUND if
+  // there is none
+  virtual const Status deleteEntry(const Record & rec, const RID & rid) = 0;
+
+  // remove all entries
+  virtual const Status truncate() = 0;
+
+  // can scans with operator op be answered by the index
+  virtual const bool supports(const Operator op) const = 0;
+
+  // does the index keep the values of attribute attr
+  virtual const bool covers(const AttrDesc & attr) const = 0;
+
+  // start a scan for the entries whose key satisfies (key op value)
+  virtual const Status startScan(const void* value, const Operator op) = 0;
+
+  // return the RID of the next matching entry; NOMORERECS at the end
+  virtual const Status scanNext(RID & rid) = 0;
+
+  // copy the covered attributes of the entry scanNext returned last
+  // into recData, at their places in the record
+  virtual const Status getCovered(char* recData) = 0;
+
+  // terminate the scan
+  virtual const Status endScan() = 0;
+};
+
+
+// name of the file holding the index on attribute attr
+extern const string indexFileName(const AttrDesc & attr);
+
+// build an index of kind type on attribute attrName of relation
+// and record it in the attribute catalog. nbuckets is the initial
+// size of a hash index; a B+-tree can also keep the values of
+// includeCnt more attributes so that scans need not fetch records
+extern const Status createIndex(const string & relation,
+				const string & attrName,
+				const IndexType type,
+				const int nbuckets,
+				const int includeCnt,
+				const attrInfo includeList[]);
+
+// empty the index on attribute attr and enter the records of its
+// relation again, for after the records moved
+extern const Status rebuildIndex(const AttrDesc & attr);
+
+// drop the index on attribute attrName of relation
+extern const Status destroyIndex(const string & relation,
+				 const string & attrName);
+
+// open the index on attribute attr (attr.indexType != NOIDX)
+extern const Status openIndex(const AttrDesc & attr, Index* & index);
+
+
+// The indexes of a relation, kept up to date together as records
+// are inserted into and deleted from the relation.
+
+class RelIndexes {
+ public:
+  // open all indexes on relation
+  RelIndexes(const string & relation, Status & status);
+
+  // close them
+  ~RelIndexes();
+
+  // does the relation have any index
+  const bool empty() const
+    {
+      return indexCnt == 0;
+    }
+
+  // add / remove the entries of record rec stored at rid
+  const Status insertEntries(const Record & rec, const RID & rid);
+  const Status deleteEntries(const Record & rec, const RID & rid);
+
+ private:
+  int indexCnt;                         // number of open indexes
+  AttrDesc* attrs;                      // indexed attributes
+  Index** indexes;                      // index of each attribute
+};
+
+#endif
@@ -1,40 +1,96 @@
 
+// hash value of a join attribute value; values equal as keys hash
+// alike
+unsigned int joinKeyHash(const char* attrPtr, const AttrDesc & attr);
+
+// are two join attribute values, each of its own attribute, equal
+// as keys
+bool joinKeyEqual(const char* k1, const AttrDesc & attr1,
+		  const char* k2, const AttrDesc & attr2);
+
+// order of two strings of lengths len1 and len2 that each end at a
+// null byte or at their length, as strcmp would give it
+int joinStrCmp(const char* s1, const int len1,
+	       const char* s2, const int len2);
+
+
+// Hash table of the records of the build side of a join, keyed on
+// the join attribute. Inserts append an entry (hash value of the key,
+// RID, copy of the key) to one growing array. The first lookup seals
+// the table: the entries are sorted by bucket in one counting pass,
+// so that the entries of a bucket, and so those of a key, lie next
+// to each other. A probe then scans the entries of one bucket,
+// comparing the stored hash values before any keys. Neither inserts
+// nor probes allocate memory, save the occasional doubling of the
+// entry array.
+
+// state of a probe, filled in by lookup
+typedef struct {
+    const char* key;		// key looked for
+    const AttrDesc* attr;	// its attribute
+    unsigned int tag;		// its hash value
+    int pos;			// next entry to look at
+    int end;			// entry after the bucket
+} joinHashProbe;
+
 class joinHashTbl
 {
 private:
-    union JAttrType
-    {
-	int iValue;
-	float fValue;
-	char* sValue;
-    };
-	
-    struct joinhashBucket
-    {
-	union JAttrType	attrValue;
-       	RID	rid;
-       	joinhashBucket*     next;    // next node in the hash table
-    };
-
-    struct HTentry
-    {
-	int bucketCnt;  // nuumber of buckets on this chain
-	joinhashBucket*   chain;  // pointer to first bucket on the chain
-    };
-
     AttrDesc 	joinAttr;
-    int 	HTSIZE;
-    HTentry 	*ht; // actual hash table
-    int  hash(const char* attr, int attrType); // returns value between 0 and HTSIZE-1
+    int		entrySize;	// bytes per entry: tag, RID, key
+    char	*entries;	// entryCnt entries, room for entryCap
+    int		entryCnt;
+    int		entryCap;
+
+    int		*bucketStart;	// first entry of each bucket, once sealed
+    unsigned int bucketMask;	// # of buckets - 1
+
+    Status seal();		// sort the entries by bucket
 
 public:
-    joinHashTbl(const int size, const AttrDesc attr);  // constructor
+    // size is the number of records expected
+    joinHashTbl(const int size, const AttrDesc attr);
     ~joinHashTbl();
 
-     // insert a new (JoinAttrValue, RID) pair into hash table
+     // insert a new (JoinAttrValue, RID) pair into hash table; all
+     // inserts come before the first lookup
      Status insert(const RID newRid,  const char* tuple);
 
-     // get RIDs of records whose join attribute value matches innerJoinAttrValue
-     Status lookup(const char* innerJoinAttrPtr, int & ridCount, RID *&outRids);
+     // start a probe for the records whose join attribute value matches
+     // innerJoinAttrPtr, a value of attribute innerAttr
+     Status lookup(const char* innerJoinAttrPtr, const AttrDesc & innerAttr,
+		   joinHashProbe & probe);
+
+     // RID of the next record of the probe; NOMORERECS after the last
+     Status nextMatch(joinHashProbe & probe, RID & rid) const;
 };
 
+
+// Blocked Bloom filter of join attribute values. All the bits of a
+// value lie in one block of 64 bytes, so a test reads one cache line.
+// A value added is always found; another one is taken for one about
+// one time in a hundred.
+
+#define BLOOMBLOCKWORDS	16	// 32-bit words per block
+#define BLOOMBITS	7	// bits set per value
+#define BLOOMBITSPERKEY	10	// bits of filter per value expected
+
+class joinBloomFilter
+{
+private:
+    AttrDesc	attr;		// type and length of the values
+    unsigned int *words;	// the filter, blockCnt blocks
+    unsigned int blockCnt;
+
+public:
+    // size is the number of values expected
+    joinBloomFilter(const int size, const AttrDesc attr);
+    ~joinBloomFilter();
+
+    // add the value at attrPtr
+    void add(const char* attrPtr);
+
+    // might the value at attrPtr, of attribute valueAttr, have been
+    // added
+    bool mayContain(const char* attrPtr, const AttrDesc & valueAttr) const;
+};
@@ -57,8 +57,10 @@ typedef enum {
     N_LOAD,
     N_PRINT,
     N_HELP,
+    N_VACUUM,
     N_SELECT,
     N_JOIN,
+    N_BAND,
     N_PRIMATTR,
     N_QUALATTR,
     N_ATTRVAL,
@@ -113,6 +115,8 @@ typedef struct node {
 	    char *relname;
 	    char *attrname;
 	    int nbuckets;
+	    struct node *includelist;
+	    int bitmap;
 	} BUILD;
 
 	// drop node */
@@ -137,6 +141,11 @@ typedef struct node {
 	    char *relname;
 	} HELP;
 
+	// vacuum node */
+	struct {
+	    char *relname;
+	} VACUUM;
+
 	// select node */
 	struct {
 	    struct node *selattr;
@@ -151,6 +160,16 @@ typedef struct node {
 	    struct node *joinattr2;
 	} JOIN;
 
+	// band join node: joinattr1 between lowattr + low
+	// and highattr + high */
+	struct {
+	    struct node *joinattr1;
+	    struct node *lowattr;
+	    struct node *low;
+	    struct node *highattr;
+	    struct node *high;
+	} BAND;
+
 	// qualified attribute node */
 	struct {
 	    char *relname;
@@ -217,14 +236,18 @@ NODE *insert_node(char *relname, NODE *attrlist);
 NODE *delete_node(char *relname, NODE *qual);
 NODE *create_node(char *relname, NODE *attrlist, NODE *primattr);
 NODE *destroy_node(char *relname);
-NODE *build_node(char *relname, char *attrname, int nbuckets);
+NODE *build_node(char *relname, char *attrname, int nbuckets,
+		 NODE *includelist, int bitmap);
 NODE *rebuild_node(char *relname, char *attrname, int nbuckets);
 NODE *drop_node(char *relname, char *attrname);
 NODE *load_node(char *relname, char *filename);
 NODE *print_node(char *relname);
 NODE *help_node(char *relname);
+NODE *vacuum_node(char *relname);
 NODE *select_node(NODE *selattr, int op, NODE *value);
 NODE *join_node(NODE *joinattr1, int op, NODE *joinattr2);
+NODE *band_node(NODE *joinattr1, NODE *lowattr, NODE *low,
+		NODE *highattr, NODE *high);
 NODE *qualattr_node(char *relname, char *attrname);
 NODE *primattr_node(char *attrname, int nbuckets);
 NODE *attrval_node(char *attrname, NODE *value);
@@ -35,6 +35,7 @@ static NODE *parse_tree;                // root of parse tree
 		RW_PRINT
 		RW_LOAD
 		RW_HELP
+		RW_VACUUM
 		RW_QUIT
 		RW_SELECT
 		RW_INTO
@@ -43,11 +44,14 @@ static NODE *parse_tree;                // root of parse tree
 		RW_DELETE
 		RW_PRIMARY
 		RW_NUMBUCKETS
+		RW_INCLUDE
+		RW_BITMAP
 		RW_ALL
 		RW_FROM
 		RW_AS
 		RW_TABLE
 		RW_AND
+		RW_BETWEEN
 		RW_OR
 		RW_NOT
 		RW_VALUES	
@@ -92,12 +96,16 @@ static NODE *parse_tree;                // root of parse tree
 		load
 		print
 		help
+		vacuum
 		quit
 		opt_primary_attr
 		opt_where
 		qual
 		selection
 		join
+		join_list
+		band
+		offset
 		non_mt_qualattr_list
 		qualattr
 /*
@@ -155,6 +163,7 @@ command
 	| load
 	| print
 	| help
+	| vacuum
 	| quit
 	| nothing
 	{
@@ -272,7 +281,19 @@ destroy
 build
 	: RW_BUILD string '(' string ')'
 	{
-		$$ = build_node($2, $4, 0);
+		$$ = build_node($2, $4, 0, NULL, 0);
+	}
+	| RW_BUILD string '(' string ')' RW_NUMBUCKETS T_EQ T_INT
+	{
+		$$ = build_node($2, $4, $8, NULL, 0);
+	}
+	| RW_BUILD string '(' string ')' RW_INCLUDE '(' attrib_list ')'
+	{
+		$$ = build_node($2, $4, 0, $8, 0);
+	}
+	| RW_BUILD string '(' string ')' RW_BITMAP
+	{
+		$$ = build_node($2, $4, 0, NULL, 1);
 	}
 	;
 
@@ -316,6 +337,13 @@ help
 	}
 	;
 
+vacuum
+	: RW_VACUUM RW_TABLE string
+	{
+		$$ = vacuum_node($3);
+	}
+	;
+
 quit
 	: RW_QUIT ';'
 	{
@@ -370,6 +398,22 @@ opt_where
 qual
 	: selection
 	| join
+	| join RW_AND join_list
+	{
+		$$ = prepend($1, $3);
+	}
+	| band
+	;
+
+join_list
+	: join RW_AND join_list
+	{
+		$$ = prepend($1, $3);
+	}
+	| join
+	{
+		$$ = list_node($1);
+	}
 	;
 
 selection
@@ -386,6 +430,44 @@ join
 	}
 	;
 
+band
+	: qualattr RW_BETWEEN qualattr offset RW_AND qualattr offset
+	{
+		$$ = band_node($1, $3, $4, $6, $7);
+	}
+	;
+
+offset
+	: '+' T_INT
+	{
+		$$ = int_node($2);
+	}
+	| '-' T_INT
+	{
+		$$ = int_node(-$2);
+	}
+	| T_INT
+	{
+		$$ = int_node($1);
+	}
+	| '+' T_REAL
+	{
+		$$ = float_node($2);
+	}
+	| '-' T_REAL
+	{
+		$$ = float_node(-$2);
+	}
+	| T_REAL
+	{
+		$$ = float_node($1);
+	}
+	| nothing
+	{
+		$$ = int_node(0);
+	}
+	;
+
 non_mt_qualattr_list
 	: '(' non_mt_qualattr_list ')'
 	{
@@ -18,12 +18,26 @@ class Partition {
 	                               // hash function to use in partitioning
 	    string* &partName,           // names of partitioned heap files
 	    Status &status);            // create partitions of file
+  Partition(const string & fileName,    // (base) name of heap file
+	    const int P,                // number of partitions
+	    string* &partName,          // names of partitioned heap files
+	    Status &status);            // create empty partitions
   ~Partition();                         // destroy partitions
 
+  // add rec to partition p
+  const Status insertRecord(const int p, const Record & rec);
+
+  // done inserting; the partitions can be read now
+  const Status close();
+
  private:
 
+  // create and open the partition files
+  const Status create(const string & fileName, const int P);
+
   int P;                                // number of partitions
   string *partName;                      // partition names
+  InsertFileScan **part;                // open partition files, if any
 };
 
 #endif
@@ -2,8 +2,10 @@
 #define QUERY_H
 
 #include "heapfile.h"
+#include "catalog.h"
+#include "index.h"
 
-enum JoinType {NLJoin, SMJoin, HashJoin};
+enum JoinType {NLJoin, SMJoin, HashJoin, RadixHashJoin, AdaptiveJoin};
 
 //
 // Prototypes for query layer functions
@@ -24,10 +26,66 @@ const Status QU_Join(const string & result,
 		     const Operator op, 
 		     const attrInfo *attr2);
 
+// band join: the pairs of records with
+// attr2 + low <= attr1 <= attr2 + high
+const Status QU_Band_Join(const string & result,
+			  const int projCnt,
+			  const attrInfo projNames[],
+			  const attrInfo *attr1,
+			  const attrInfo *attr2,
+			  const double low,
+			  const double high);
+
+// join of more than two relations, on the conjunction of joinCnt
+// predicates joinAttrs1[k] ops[k] joinAttrs2[k]
+const Status QU_MultiJoin(const string & result,
+			  const int projCnt,
+			  const attrInfo projNames[],
+			  const int joinCnt,
+			  const attrInfo joinAttrs1[],
+			  const Operator ops[],
+			  const attrInfo joinAttrs2[]);
+
 const Status QU_Insert(const string & relation, 
 		       const int attrCnt, 
 		       const attrInfo attrList[]);
 
+
+//
+// A prepared insert resolves the schema of a relation once and keeps
+// its heap file open, so that a stream of single-row inserts into the
+// same relation skips the catalog lookups and the setup of a new
+// InsertFileScan. The relation must not be changed by anything else
+// while the handle is open.
+//
+
+class PreparedInsert {
+ public:
+  // resolve the schema of relation and open it
+  PreparedInsert(const string & relation, Status & status);
+
+  // close the relation
+  ~PreparedInsert();
+
+  // relation the handle inserts into
+  const string & getRelation() const
+    {
+      return relation;
+    }
+
+  // insert one record, attributes given as for QU_Insert
+  const Status insert(const int attrCnt, const attrInfo attrList[]);
+
+ private:
+  string relation;                      // relation name
+  int attrCnt;                          // number of attributes
+  AttrDesc* attrs;                      // attributes, in catalog order
+  int recLen;                           // length of a record
+  char* recBuf;                         // record being assembled
+  InsertFileScan* inserter;             // open heap file of relation
+  RelIndexes* indexes;                  // open indexes of relation
+};
+
 const Status QU_Delete(const string & relation, 
 		       const string & attrName, 
 		       const Operator op,
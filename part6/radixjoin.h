@@ -0,0 +1,125 @@
+#ifndef RADIXJOIN_H
+#define RADIXJOIN_H
+
+#include <pthread.h>
+#include "catalog.h"
+
+
+// In-memory equi-join of two relations read into arrays of fixed
+// length tuples, run by several threads.
+//
+// Both relations are radix partitioned on the low bits of the hash
+// value of their join attribute, in one or two passes, until a
+// partition of the build side and its hash table fit in the L2 cache.
+// In the first pass every thread histograms and then scatters its own
+// slice of the input, to places set aside for it from the histograms
+// of all threads, so that no two threads write to the same place. The
+// second pass splits the partitions of the first, one task each.
+// Then the pairs of partitions are joined, biggest first, each by the
+// thread that takes it off a shared task counter. A thread writes its
+// result tuples to its own buffer; no locks are taken anywhere.
+
+#define RADIXCACHEBYTES	(256 * 1024)	// L2 cache a partition should fit in
+#define RADIXPASSBITS	8		// radix bits per partitioning pass
+#define RADIXMAXTHREADS	64
+
+// a relation held in memory
+typedef struct {
+    const char *data;		// tupCnt tuples of tupLen bytes each
+    int tupCnt;
+    int tupLen;
+    AttrDesc attr;		// join attribute
+} RadixRel;
+
+// an attribute of the result tuples
+typedef struct {
+    bool fromBuild;		// taken from the build or the probe tuple
+    int offset;			// where it is in that tuple
+    int len;
+} RadixProj;
+
+// result tuples of one thread
+typedef struct {
+    char *data;			// tupCnt tuples of the result tuple length
+    int tupCnt;
+    int cap;			// room for this many
+} RadixOutput;
+
+// a tuple as partitioned: hash value of its join attribute and its
+// place in the relation
+typedef struct {
+    unsigned int hash;
+    int idx;
+} RadixEntry;
+
+// read relation relName into rel; see radixjoin.C
+const Status loadRadixRel(const string & relName, const AttrDesc & attr,
+			  RadixRel & rel);
+
+class RadixJoin {
+ public:
+    // join build and probe, giving result tuples of projCnt
+    // attributes; the arrays must outlive the object
+    RadixJoin(const RadixRel & build,
+	      const RadixRel & probe,
+	      const int projCnt,
+	      const RadixProj proj[],
+	      const int threadCnt);
+    ~RadixJoin();
+
+    // do the join
+    const Status join();
+
+    // result tuples of thread t, valid until the object is destroyed
+    const RadixOutput & getOutput(const int t) const { return output[t]; }
+
+    int getThreadCnt() const { return threadCnt; }
+    int getPartCnt() const { return partCnt; }
+    int getResultLen() const { return resultLen; }
+
+ private:
+    // one relation as it is partitioned
+    typedef struct {
+	const RadixRel *rel;
+	RadixEntry *entries;	// the tuples, in partition order
+	RadixEntry *tmp;	// as much room again, for scattering
+	int *partStart;		// first entry of each partition, and tupCnt
+    } Side;
+
+    Side side[2];		// build, probe
+    int projCnt;
+    const RadixProj *proj;
+    int resultLen;
+    int threadCnt;
+
+    int bits1, bits2;		// radix bits of the two passes
+    int partCnt;		// 1 << (bits1 + bits2)
+    int *hist;			// first pass histograms, per side and thread
+    int *order;			// partitions, biggest build side first
+    volatile int nextTask;	// next task to take
+
+    RadixOutput *output;	// per thread
+    Status *threadStatus;
+
+    // what a thread is to do
+    enum Phase { HISTOGRAM, SCATTER, SPLIT, PROBE };
+    Phase phase;
+
+    typedef struct {
+	RadixJoin *join;
+	int t;
+    } ThreadArg;
+
+    static void *threadMain(void *arg);
+    const Status runThreads(const Phase p);
+    const int takeTask();
+
+    void histogram(const int t);
+    void scatter(const int t);
+    const Status split(const int t);
+    const Status probe(const int t);
+    const Status emit(const int t, const char *buildTup,
+		      const char *probeTup);
+};
+
+#endif
@@ -6,6 +6,8 @@
 // define if debug output wanted
 //#define DEBUGSORT
 
+#define SORTBLOCKPAGES 4                // pages of a run read at a time
+
 
 // SORTREC is an in-memory sort record that qsort(3) sorts.
 // The sort attribute as well as the associated RID are
@@ -19,38 +21,126 @@ typedef struct {
 } SORTREC;
 
 
+// HEAPREC is an entry of the selection heap of replacement
+// selection: a whole record of the source file, copied, and
+// the number of the run it is to be written to.
+
+typedef struct {
+  int run;                              // run the record goes to
+  int ikey;                             // sort attribute, if a number
+  float fkey;
+  char* data;                           // copy of the record
+  int length;                           // length of the record
+} HEAPREC;
+
+
+// How the source file is cut into sorted runs. QSORTRUNS fills
+// memory with maxItems records, sorts them, and writes them out,
+// so that every run has maxItems records. SELECTRUNS keeps a heap
+// of maxItems records and writes out the smallest one that still
+// fits into the current run (replacement selection): on random
+// input runs are about twice as long, and an input that is nearly
+// in order makes a single run.
+
+enum RunMode { QSORTRUNS, SELECTRUNS };
+
+
+struct SortStats
+{
+  int runCnt;        // Number of sorted runs written
+  int recCnt;        // Number of records written to them
+  int minRunLen;     // Records in the shortest run
+  int maxRunLen;     // Records in the longest run
+  int mergeCnt;      // Number of merges before the last one
+
+  void clear()
+    {
+      runCnt = recCnt = minRunLen = maxRunLen = mergeCnt = 0;
+    }
+
+  SortStats()
+    {
+      clear();
+    }
+};
+
+
 class SortedFile {
  public:
   SortedFile(const string & fileName, 
 	     int offset,// sort source file on the given
 	     int length, Datatype type, // attribute
-	     int maxItems, Status& status);
+	     int maxItems, Status& status,
+	     RunMode mode = SELECTRUNS);
 
   Status next(Record & rec);            // fetch next record in sort order
   Status setMark();                     // record a position in sort sequence
   Status gotoMark();                    // go to last recorded spot
   ~SortedFile();                        // destroy temporary structures / files
 
+  const SortStats & getSortStats() const // get run statistics
+  {
+    return sortStats;
+  }
+
  private:
   Status sortFile();                    // split source file into sub-runs
-  Status generateRun(int numItems);     // generate one sub-run of file
-  Status startScans();                  // start a scan on each sorted run
+  Status checkOrder(bool & inOrder);    // is source file sorted already
+  Status generateRun(int numItems,      // generate one sub-run of file
+		     int numBytes);
+  Status selectRuns();                  // generate all runs of the file
+                                        // by replacement selection
+  void setKey(HEAPREC & rec);           // fetch key of a heap record
+  bool smaller(const HEAPREC & a,       // a goes before b in the heap
+	       const HEAPREC & b) const;
+  void siftDown(HEAPREC heap[],         // restore heap order below i
+		int cnt, int i);
+  Status createRun();                   // create the file of a new run
+  void countRun(int recCnt);            // add a run to sortStats
+  Status startMerge();                  // merge down to one merge's runs
+  Status mergeRuns(int cnt);            // merge the first cnt runs
+  Status startScans(int cnt);           // start a scan on the first
+                                        // cnt sorted runs
 
   typedef struct {
     string name;                        // name of run file
-    HeapFileScan* inFile;               // ptr to input file
+    HeapFile* inFile;                   // ptr to input file
     InsertFileScan* outFile;		// ptr to output file
-    int valid;                          // TRUE if recPtr has a record
-    Record rec;
-    RID rid;                            // RID of current record of run
-    RID mark;
+    int pageNo;                         // first page of the batch,
+                                        // -1 once the run is used up
+    int nextPageNo;                     // page after the block, -1 if none
+    char* batch;                        // copy of the records of the block
+    Record* recs;                       // the records in the batch
+    int recCnt;                         // number of records in the batch
+    int pos;                            // current record in the batch
+    const char* key;                    // its sort attribute
+    int ikey;                           // same, as a number
+    float fkey;
+    int markPageNo;                     // pageNo and pos at setMark()
+    int markPos;
   } RUN;
 
+  Status readBatch(RUN & run, int pageNo); // read a block of a run
+  void setKey(RUN & run);               // fetch key of current record
+  bool before(int a, int b) const;      // run a's record goes first
+  int buildTree(int node);              // loser tree of a subtree
+  void replay(int r);                   // play run r up the tree again
+
   vector<RUN> runs;                   // holds info about each sub-run
+  int activeRuns;                     // runs being merged, the first
+                                      // ones of runs[]
+  vector<int> tree;                   // loser tree over the runs: the
+                                      // winner in tree[0], the loser of
+                                      // each match in tree[1..k-1]
+  int advance;                        // run of the record next() gave
+                                      // last, -1 if none or after gotoMark
+  int runFiles;                       // run files created, to name them
 
   HeapFile* hfile;                   // source file to sort
   HeapFileScan* hfs;                   // source file to sort
   string fileName;                      // name of source file to sort
+  bool inPlace;                         // source file was sorted already
+                                        // and is read as the only run
   Datatype type;                        // type of sort attribute
   int offset;                           // offset of sort attribute
   int length;                           // length of sort attribute
@@ -58,6 +148,8 @@ class SortedFile {
   SORTREC* buffer;                      // in-memory sort buffer
   int maxItems;                         // max. # of items/tuples in buffer
   int numItems;                         // current # of items in buffer
+  RunMode mode;                         // how runs are generated
+  SortStats sortStats;                  // runs generated
 };
 
 #endif
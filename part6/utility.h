@@ -27,6 +27,8 @@ const Status UT_Load(const string & relation,
 
 const Status UT_Print(string relation);
 
+const Status UT_Vacuum(const string & relation);
+
 void   UT_Quit(void);
 
 #endif
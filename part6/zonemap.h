@@ -0,0 +1,125 @@
+#ifndef ZONEMAP_H
+#define ZONEMAP_H
+
+#include "page.h"
+#include "buf.h"
+
+extern DB db;
+
+// define if debug output wanted
+//#define DEBUGZONE
+
+
+// A zone map keeps a small summary (record count, min and max value
+// of a few attributes) for every data page of a heap file. It is
+// stored in a sidecar file (fileName.zmap) next to the heap file and
+// lets a filtered scan skip pages that cannot hold a matching record
+// without reading them into the buffer pool.
+
+#define ZONEMAPSUFFIX ".zmap"           // suffix of sidecar file name
+#define ZONEMAXATTRS  8                 // max. # of summarized attributes
+#define ZONEPREFIX    8                 // bytes of string kept in summary
+
+
+// description of a summarized attribute
+
+typedef struct {
+  int offset;                           // byte offset in record
+  int length;                           // length of attribute
+  int type;                             // INTEGER, FLOAT, or STRING
+} ZoneAttr;
+
+
+// summarized value: numeric values are kept exactly, strings
+// by their first ZONEPREFIX bytes
+
+typedef union {
+  int iValue;
+  float fValue;
+  char sValue[ZONEPREFIX];
+} ZoneVal;
+
+
+// header page of the sidecar file
+
+typedef struct {
+  int attrCnt;                          // number of summarized attributes
+  ZoneAttr attrs[ZONEMAXATTRS];         // summarized attributes
+  int entrySize;                        // size of one page entry in bytes
+  int entriesPerPage;                   // entries on one entry page
+  int firstEntryPage;                   // page # of first entry page
+  int entryPageCnt;                     // number of entry pages
+} ZoneHdrPage;
+
+
+// one entry per data page, indexed by data page number. The entry
+// repeats the page's forward pointer so that a scan can step over
+// a page without pinning it. attrCnt (min, max) pairs follow.
+
+typedef struct {
+  int nextPage;                         // copy of nextPage of data page
+  int recCnt;                           // # of records summarized
+} ZoneEntry;
+
+
+class ZoneMap {
+ public:
+  // open the zone map of heap file fileName
+  ZoneMap(const string & fileName, Status & status);
+
+  // close the zone map
+  ~ZoneMap();
+
+  // find summarized attribute matching a scan predicate; -1 if none
+  const int findAttr(const int offset, const int length,
+		     const int type) const;
+
+  // record was inserted on page pageNo
+  const Status noteInsert(const int pageNo, const Record & rec);
+
+  // page newPageNo was linked in after page prevPageNo
+  const Status noteAppend(const int prevPageNo, const int newPageNo);
+
+  // recompute the summary of a (pinned) page after deletions
+  const Status rebuildPage(const int pageNo, Page* page);
+
+  // starting at pageNo, follow the page chain past every page whose
+  // summary rules out a match of (attr op filter); skipped is
+  // incremented for every page stepped over
+  const Status skipPages(int & pageNo, const int attr,
+			 const char* filter, const int op,
+			 int & skipped);
+
+ private:
+  File* filePtr;                        // sidecar file
+  ZoneHdrPage* hdr;                     // pinned header page
+  int hdrPageNo;                        // page # of header page
+  bool hdrDirty;                        // header page has been updated
+
+  // pin the entry of data page pageNo, growing the map if needed
+  const Status getEntry(const int pageNo, int & entryPageNo,
+			Page* & entryPage, ZoneEntry* & entry);
+
+  // summary value of attribute i in an entry
+  ZoneVal* minOf(ZoneEntry* entry, const int i) const;
+  ZoneVal* maxOf(ZoneEntry* entry, const int i) const;
+
+  // fold attribute values of rec into an entry
+  void addRecord(ZoneEntry* entry, const Record & rec) const;
+
+  // can a page summarized by entry hold a record with (attr op filter)?
+  const bool mayMatch(ZoneEntry* entry, const int attr,
+		      const char* filter, const int op) const;
+};
+
+
+// create the sidecar file of heap file fileName and summarize the
+// pages the heap file already has
+extern const Status createZoneMap(const string & fileName,
+				  const int attrCnt,
+				  const ZoneAttr attrs[]);
+
+// destroy the sidecar file of heap file fileName, if any
+extern const Status destroyZoneMap(const string & fileName);
+
+#endif